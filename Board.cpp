@@ -20,9 +20,16 @@ public:
 	bool allShipsDestroyed() const;
 
 private:
+	char& cell(int r, int c) { return grid[r * n_cols + c]; }
+	char cell(int r, int c) const { return grid[r * n_cols + c]; }
+	void readFleet();
+
 	const Game& m_game; 
-	char grid[MAXROWS][MAXCOLS]; // board
-	vector<int> shipIDs; // vector of current shipIds
+	int n_cols; // row stride of grid
+	vector<char> grid; // board, rows() x cols() cells stored row by row in one block
+	vector<bool> placed; // placed[shipId] is true while that ship is on the board
+	int symbolToId[256]; // shipId for each ship symbol, -1 for anything else
+	vector<int> cellsLeft; // unhit cells left for each shipId, so a sink is known without rescanning the grid
 	int n_shipsDestroyed; 
 };
 
@@ -32,28 +39,51 @@ const char isMISS = 'o';
 const char isBLOCKED = '#';
 
 BoardImpl::BoardImpl(const Game& g)
-	: m_game(g)
+	: m_game(g), n_cols(g.cols()), grid(g.rows() * g.cols())
 {
 	n_shipsDestroyed = 0;
+	for (int i = 0; i < 256; i++)
+		symbolToId[i] = -1;
+	readFleet();
 	clear(); // reset the board
 }
 
+void BoardImpl::readFleet()
+{
+	// ships can still be added to the game after this board was made, so catch up on any new ones
+	int known = placed.size();
+	placed.resize(m_game.nShips(), false);
+	cellsLeft.resize(m_game.nShips(), 0);
+	for (int k = known; k < m_game.nShips(); k++)
+		symbolToId[(unsigned char)m_game.shipSymbol(k)] = k;
+}
+
 void BoardImpl::clear()
 {
 	for (int r = 0; r < m_game.rows(); r++)
 		for (int c = 0; c < m_game.cols(); c++)
-			grid[r][c] = isWATER; // making everything water
+			cell(r, c) = isWATER; // making everything water
 }
 
 void BoardImpl::block()
 {
-	// Block cells with 50% probability
+	// Block cells with 50% probability, taking 30 random bits per randInt call instead of one
+	int bits = 0, bitsLeft = 0;
 	for (int r = 0; r < m_game.rows(); r++)
 		for (int c = 0; c < m_game.cols(); c++)
-			if (randInt(2) == 0)
+		{
+			if (bitsLeft == 0)
+			{
+				bits = randInt(1 << 30);
+				bitsLeft = 30;
+			}
+			if (bits & 1)
 			{
-				grid[r][c] = isBLOCKED;
+				cell(r, c) = isBLOCKED;
 			}
+			bits >>= 1;
+			bitsLeft--;
+		}
 }
 
 void BoardImpl::unblock()
@@ -61,8 +91,8 @@ void BoardImpl::unblock()
 	for (int r = 0; r < m_game.rows(); r++)
 		for (int c = 0; c < m_game.cols(); c++)
 		{
-			if (grid[r][c] == isBLOCKED)
-				grid[r][c] = isWATER;
+			if (cell(r, c) == isBLOCKED)
+				cell(r, c) = isWATER;
 		}
 }
 
@@ -70,106 +100,87 @@ bool BoardImpl::placeShip(Point topOrLeft, int shipId, Direction dir)
 {
 	if (shipId < 0 || shipId >= m_game.nShips()) // invalid shipId
 		return false;
+	if (shipId >= (int)placed.size())
+		readFleet();
 	
-	for (int i = 0; i < shipIDs.size(); i++) {
-		if (shipId == shipIDs[i])
-			return false; // already used this shipID.
-	}
+	if (placed[shipId])
+		return false; // already used this shipID.
 
-	if (dir == HORIZONTAL) {
-		for (int k = 0; k < m_game.shipLength(shipId); k++) { 
-			if (topOrLeft.c + k < 0 || topOrLeft.c + k >= m_game.cols()) // checking if falls off the board
-				return false;
-			if (grid[topOrLeft.r][topOrLeft.c + k] != isWATER) // checking if overlapping something
-				return false;
-		}
-		for (int i = 0; i < m_game.shipLength(shipId); i++)
-			grid[topOrLeft.r][topOrLeft.c+ i] = m_game.shipSymbol(shipId); // placing symbol on grid
+	if (dir != HORIZONTAL && dir != VERTICAL)
+		return false; // didn't enter valid direction
 
-		shipIDs.push_back(shipId); // everything was cool, so add to vector
-		return true;
+	// both directions walk the same cells, just stepping along a different axis
+	int dr = (dir == VERTICAL) ? 1 : 0;
+	int dc = (dir == HORIZONTAL) ? 1 : 0;
+	int len = m_game.shipLength(shipId);
+
+	for (int k = 0; k < len; k++) {
+		Point p(topOrLeft.r + k * dr, topOrLeft.c + k * dc);
+		if (!m_game.isValid(p)) // checking if falls off the board
+			return false;
+		if (cell(p.r, p.c) != isWATER) // checking if overlapping something
+			return false;
 	}
+	for (int k = 0; k < len; k++)
+		cell(topOrLeft.r + k * dr, topOrLeft.c + k * dc) = m_game.shipSymbol(shipId); // placing symbol on grid
+	cellsLeft[shipId] = len;
 
-	else if (dir == VERTICAL) {
-		for (int k = 0; k < m_game.shipLength(shipId); k++) { 
-			if (topOrLeft.r + k < 0 || topOrLeft.r + k >= m_game.rows()) // checking if falls off the board
-				return false;
-			if (grid[topOrLeft.r + k][topOrLeft.c] != isWATER) // checking if overlapping something
-				return false;
-		}
-		for (int i = 0; i < m_game.shipLength(shipId); i++)
-			grid[topOrLeft.r + i][topOrLeft.c] = m_game.shipSymbol(shipId); // placing on grid
-
-		shipIDs.push_back(shipId); // everything was cool, so add to vector
-		return true;
-	}
-	else {
-		return false; // didn't enter valid direction
-	}
+	placed[shipId] = true; // everything was cool, so mark it placed
+	return true;
 }
 
 bool BoardImpl::unplaceShip(Point topOrLeft, int shipId, Direction dir)
 {
 	if (shipId < 0 || shipId >= m_game.nShips()) // invalid shipId
 		return false;
+	if (shipId >= (int)placed.size())
+		readFleet();
 
-	bool found = false; 
-	for (int i = 0; i < shipIDs.size(); i++) { // checking whether shipId even exists
-		if (shipId == shipIDs[i])
-			found = true;
-	}
-	if (!found)
+	if (!placed[shipId]) // checking whether shipId even exists
 		return false;
-	
-	if (dir == HORIZONTAL) {
-		for (int p = 0; p < m_game.shipLength(shipId); p++) {
-			if (grid[topOrLeft.r][topOrLeft.c + p] != m_game.shipSymbol(shipId)) // checking if the spaces it's going over isn't the ship
-				return false;
-		}
-		for (int k = 0; k < m_game.shipLength(shipId); k++) { // writing over ship
-			grid[topOrLeft.r][topOrLeft.c + k] = isWATER;
-		}
-		shipIDs.erase(shipIDs.begin() + shipId); // removing shipId
-		return true;
-	}
 
-	else if (dir == VERTICAL) {
-		for (int p = 0; p < m_game.shipLength(shipId); p++) {
-			if (grid[topOrLeft.r + p][topOrLeft.c] != m_game.shipSymbol(shipId)) // checking if the spaces it's going over isn't the ship
-				return false;
-		}
-		for (int k = 0; k < m_game.shipLength(shipId); k++) { // writing over ship
-			grid[topOrLeft.r + k][topOrLeft.c] = isWATER;
-		}
-		shipIDs.erase(shipIDs.begin() + shipId); // removing shipId
-		return true;
-	}
-	else {
+	if (dir != HORIZONTAL && dir != VERTICAL)
 		return false; // didn't enter valid direction
+
+	int dr = (dir == VERTICAL) ? 1 : 0;
+	int dc = (dir == HORIZONTAL) ? 1 : 0;
+	int len = m_game.shipLength(shipId);
+
+	for (int k = 0; k < len; k++) {
+		Point p(topOrLeft.r + k * dr, topOrLeft.c + k * dc);
+		if (!m_game.isValid(p) || cell(p.r, p.c) != m_game.shipSymbol(shipId)) // checking if the spaces it's going over isn't the ship
+			return false;
 	}
+	for (int k = 0; k < len; k++) // writing over ship
+		cell(topOrLeft.r + k * dr, topOrLeft.c + k * dc) = isWATER;
+
+	placed[shipId] = false; // removing shipId
+	return true;
 }
 
 void BoardImpl::display(bool shotsOnly) const
 {
+	// rows end in '\n' rather than endl so displaying a board doesn't flush once per row;
+	// cout is tied to cin, so it still gets flushed before a human is asked for input
 	cout << "  "; // 2 space indent
 	for (int c = 0; c < m_game.cols(); c++) // creating header of numbers
 		cout << c;
-	cout << endl;
+	cout << '\n';
 
 	for (int r = 0; r < m_game.rows(); r++) {
 		cout << r << " "; // beginning of each row
 		for (int c = 0; c < m_game.cols(); c++) {
 			if (shotsOnly) {
-				if (grid[r][c] != isHIT && grid[r][c] != isMISS) // if there's something there other than a hit or missed shot, just put water to cover it
+				if (cell(r, c) != isHIT && cell(r, c) != isMISS) // if there's something there other than a hit or missed shot, just put water to cover it
 					cout << isWATER;
 				else
-					cout << grid[r][c]; // keep displaying X and o
+					cout << cell(r, c); // keep displaying X and o
 			}
 			else {
-				cout << grid[r][c]; // show what it was, whether it be ship symbols or not
+				cout << cell(r, c); // show what it was, whether it be ship symbols or not
 			}
 		}
-		cout << endl;
+		cout << '\n';
 	}
 }
 
@@ -177,31 +188,25 @@ bool BoardImpl::attack(Point p, bool& shotHit, bool& shipDestroyed, int& shipId)
 {
 	shotHit = false; // in case we get an early 'return false'
 	shipDestroyed = false;
-	int k = 0; // counting purposes
 
 	if (p.r < 0 || p.r >= m_game.rows()) // invalid point location
 		return false;
 	if (p.c < 0 || p.c >= m_game.cols())
 		return false;
 
-	if (grid[p.r][p.c] == isHIT || grid[p.r][p.c] == isMISS) // if attacking an X or o, then return false
+	if (cell(p.r, p.c) == isHIT || cell(p.r, p.c) == isMISS) // if attacking an X or o, then return false
 		return false;
-	else {
-		for (k; k < m_game.nShips(); k++)
-			if (grid[p.r][p.c] == m_game.shipSymbol(k)) {  // if you hit a ship
-				grid[p.r][p.c] = isHIT;
-				shotHit = true;
-				break;
-			}
-		if (!shotHit) 
-			grid[p.r][p.c] = isMISS; // missed shot
+	int k = symbolToId[(unsigned char)cell(p.r, p.c)]; // which ship is here, if any
+	if (k != -1) {  // if you hit a ship
+		cell(p.r, p.c) = isHIT;
+		shotHit = true;
 	}
+	else
+		cell(p.r, p.c) = isMISS; // missed shot
+
 	if (shotHit) { // only if it's a hit, do we check if it's destroyed
-		shipDestroyed = true;
-		for (int r = 0; r < m_game.rows(); r++)
-			for (int c = 0; c < m_game.cols(); c++)
-				if (grid[r][c] == m_game.shipSymbol(k)) // if the symbol is still on the board, then it's not destroyed
-					shipDestroyed = false;
+		cellsLeft[k]--;
+		shipDestroyed = (cellsLeft[k] == 0); // no unhit cells of that ship left
 
 		if (shipDestroyed) {
 			n_shipsDestroyed++;
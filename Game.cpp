@@ -23,9 +23,12 @@ public:
 	int shipLength(int shipId) const;
 	char shipSymbol(int shipId) const;
 	string shipName(int shipId) const;
+	int totalShipLength() const;
+	bool symbolInUse(char symbol) const;
 	Player* play(Player* p1, Player* p2, Board& b1, Board& b2, bool shouldPause);
-	~GameImpl();
 private:
+	bool takeTurn(Player* attacker, const string& attackerName, bool attackerIsHuman,
+		const string& defenderName, Board& defenderBoard, bool shouldPause); // true if attacker won
 	int n_rows;
 	int n_cols;
 	struct Ship {
@@ -35,7 +38,9 @@ private:
 		char m_symbol;
 		string m_name;
 	};
-	vector<Ship*> myShips;
+	vector<Ship> myShips; // stored by value, so the whole fleet is one allocation
+	int n_totalLength; // sum of all ship lengths so far
+	bool symbolUsed[256]; // symbolUsed[c] is true once a ship uses c as its symbol
 };
 
 void waitForEnter()
@@ -48,12 +53,9 @@ GameImpl::GameImpl(int nRows, int nCols)
 {
 	n_rows = nRows;
 	n_cols = nCols;
-}
-
-GameImpl::~GameImpl() { // do I need?
-	int n = myShips.size();
-	for (int i = 0; i < n; i++)
-		delete myShips[i];
+	n_totalLength = 0;
+	for (int i = 0; i < 256; i++)
+		symbolUsed[i] = false;
 }
 
 int GameImpl::rows() const
@@ -78,7 +80,9 @@ Point GameImpl::randomPoint() const
 
 bool GameImpl::addShip(int length, char symbol, string name)
 {
-	myShips.push_back(new Ship(length, symbol, name));
+	myShips.push_back(Ship(length, symbol, name));
+	n_totalLength += length;
+	symbolUsed[(unsigned char)symbol] = true;
 	return true;
 }
 
@@ -89,125 +93,101 @@ int GameImpl::nShips() const
 
 int GameImpl::shipLength(int shipId) const
 {
-	return myShips[shipId]->m_length; 
+	return myShips[shipId].m_length; 
 }
 
 char GameImpl::shipSymbol(int shipId) const
 {
-	return myShips[shipId]->m_symbol; 
+	return myShips[shipId].m_symbol; 
 }
 
 string GameImpl::shipName(int shipId) const
 {
-	return myShips[shipId]->m_name; 
+	return myShips[shipId].m_name; 
+}
+
+int GameImpl::totalShipLength() const
+{
+	return n_totalLength;
+}
+
+bool GameImpl::symbolInUse(char symbol) const
+{
+	return symbolUsed[(unsigned char)symbol];
+}
+
+bool GameImpl::takeTurn(Player* attacker, const string& attackerName, bool attackerIsHuman,
+	const string& defenderName, Board& defenderBoard, bool shouldPause)
+{
+	cout << attackerName << "'s turn. Board for " << defenderName << endl;
+	if (attackerIsHuman)
+		defenderBoard.display(true); // if human, don't display other player's ships
+	else
+		defenderBoard.display(false); // otherwise, do
+
+	Point a = attacker->recommendAttack(); // prompting player where to attack
+
+	bool  shotHit, shipDestroyed, validShot;
+	int shipId;
+
+	if (!defenderBoard.attack(a, shotHit, shipDestroyed, shipId)) {
+		cout << attackerName << " wasted a shot at (" << a.r << "," << a.c << ")." << endl; // wasted shot
+		validShot = false;
+	}
+	else {
+		validShot = true;
+		string hitOrMiss;
+		if (shotHit && !shipDestroyed) // a ship was hit but not destroyed
+			hitOrMiss = "hit something";
+		else if (shipDestroyed) // ship was destroyed
+			hitOrMiss = "destroyed the " + shipName(shipId);
+		else
+			hitOrMiss = "missed"; // MISSED!!
+
+		cout << attackerName << " attacked (" << a.r << "," << a.c << ") and " << hitOrMiss \
+			<< ", resulting in:" << endl; // stating what just happened
+
+		if (attackerIsHuman)
+			defenderBoard.display(true); // if human, don't display other player's ships
+		else
+			defenderBoard.display(false); // otherwise, do
+	}
+
+	attacker->recordAttackResult(a, validShot, shotHit, shipDestroyed, shipId);
+
+	if (defenderBoard.allShipsDestroyed()) { // ball game
+		cout << attackerName << " wins!" << endl;
+		return true;
+	}
+
+	if (shouldPause) { // if got to pause
+		cout << "Press Enter to Continue: ";
+		cin.ignore(10000, '\n');
+	}
+	return false;
 }
 
 Player* GameImpl::play(Player* p1, Player* p2, Board& b1, Board& b2, bool shouldPause)
 {
 	shouldPause = false;
-	Player* winner = nullptr;
 	if (!p1->placeShips(b1) || !p2->placeShips(b2)) // if there was any error placing the ships
 		return nullptr;
 
-	bool gameOn = true;
-	while (gameOn) {
-		{ // everything is within a scope, so that local variables eventually get destroyed
-			cout << p1->name() << "'s turn. Board for " << p2->name() << endl;
-			if (p1->isHuman())
-				b2.display(true); // if human, don't display other player's ships
-			else
-				b2.display(false); // otherwise, do
-
-			Point a = p1->recommendAttack(); // prompting player where to attack
-			
-			bool  shotHit, shipDestroyed, validShot;
-			int shipId;
-
-			if (!b2.attack(a, shotHit, shipDestroyed, shipId)) { 
-				cout << p1->name() << " wasted a shot at (" << a.r << "," << a.c << ")." << endl; // wasted shot
-				validShot = false;
-			}
-			else {
-				validShot = true;
-				string hitOrMiss;
-				if (shotHit && !shipDestroyed) // a ship was hit but not destroyed
-					hitOrMiss = "hit something";
-				else if (shipDestroyed) // ship was destroyed
-					hitOrMiss = "destroyed the " + shipName(shipId);
-				else
-					hitOrMiss = "missed"; // MISSED!!
-
-				cout << p1->name() << " attacked (" << a.r << "," << a.c << ") and " << hitOrMiss \
-					<< ", resulting in:" << endl; // stating what just happened
-				
-				if (p1->isHuman()) 
-					b2.display(true); // if human, don't display other player's ships
-				else
-					b2.display(false); // otherwise, do
-			}
-
-			p1->recordAttackResult(a, true, shotHit, shipDestroyed, shipId);
-
-			if (b2.allShipsDestroyed()) { // ball game
-				cout << p1->name() << " wins!" << endl;
-				winner = p1;
-				gameOn = false;
-				break;
-			}
-
-			if (shouldPause) { // if got to pause
-				cout << "Press Enter to Continue: ";
-				cin.ignore(10000, '\n');
-			}
-
-			// Player 2 (again within brackets), same thing except roles are reversed.
-		} {
-			cout << p2->name() << "'s turn. Board for " << p1->name() << endl;
-			if (p2->isHuman())
-				b1.display(true);
-			else
-				b1.display(false);
-
-			Point a = p2->recommendAttack();
-			bool  shotHit, shipDestroyed;
-			int shipId;
-
-			if (!b1.attack(a, shotHit, shipDestroyed, shipId))
-				cout << p2->name() << " wasted a shot at (" << a.r << "," << a.c << ")." << endl;
-			else {
-				string hitOrMiss;
-				if (shotHit && !shipDestroyed)
-					hitOrMiss = "hit something";
-				else if (shipDestroyed)
-					hitOrMiss = "destroyed the " + shipName(shipId);
-				else
-					hitOrMiss = "missed";
-				cout << p2->name() << " attacked (" << a.r << "," << a.c << ") and " << hitOrMiss \
-					<< ", resulting in:" << endl;
-
-				if (p2->isHuman())
-					b1.display(true); 
-				else
-					b1.display(false);
-			}
-
-			p2->recordAttackResult(a, true, shotHit, shipDestroyed, shipId);
-
-			if (b1.allShipsDestroyed()) {
-				cout << p2->name() << " wins!" << endl;
-				winner = p2;
-				gameOn = false;
-				break;
-			}
-
-			if (shouldPause) {
-				cout << "Press Enter to Continue: ";
-				cin.ignore(10000, '\n');
-			}
-		}
-	}
-	return winner;
+	// player k attacks boards[k]; the turn body is shared, so the loop just rotates the attacker
+	Player* players[2] = { p1, p2 };
+	Board* boards[2] = { &b2, &b1 };
 
+	// names and human-ness don't change during a game, so look them up once instead of every turn
+	const string names[2] = { p1->name(), p2->name() };
+	const bool isHuman[2] = { p1->isHuman(), p2->isHuman() };
+
+	int current = 0;
+	for (;;) {
+		int other = 1 - current;
+		if (takeTurn(players[current], names[current], isHuman[current], names[other], *boards[current], shouldPause))
+			return players[current]; // current player sank the last ship
+		current = other;
+	}
 }
 
 //******************** Game functions *******************************
@@ -280,18 +260,13 @@ bool Game::addShip(int length, char symbol, string name)
 			<< endl;
 		return false;
 	}
-	int totalOfLengths = 0;
-	for (int s = 0; s < nShips(); s++)
+	if (m_impl->symbolInUse(symbol))
 	{
-		totalOfLengths += shipLength(s);
-		if (shipSymbol(s) == symbol)
-		{
-			cout << "Ship symbol " << symbol
-				<< " must not be used for more than one ship" << endl;
-			return false;
-		}
+		cout << "Ship symbol " << symbol
+			<< " must not be used for more than one ship" << endl;
+		return false;
 	}
-	if (totalOfLengths + length > rows() * cols())
+	if (m_impl->totalShipLength() + length > rows() * cols())
 	{
 		cout << "Board is too small to fit all ships" << endl;
 		return false;
@@ -4,8 +4,11 @@
 #include "globals.h"
 #include <iostream>
 #include <string>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
 #include <vector>
-#include <queue>
+#include <utility>
 using namespace std;
 
 //*********************************************************************
@@ -71,11 +74,24 @@ void AwfulPlayer::recordAttackByOpponent(Point  p )
 
 bool getLineWithTwoIntegers(int& r, int& c)
 {
-	bool result(cin >> r >> c);
-	if (!result)
-		cin.clear();  // clear error state so can do more input operations
-	cin.ignore(10000, '\n');
-	return result;
+	// read the whole line once and pick the two integers out of it, rather than
+	// extracting through the stream and then skipping the rest with cin.ignore
+	string line;
+	if (!getline(cin, line))
+		return false;
+	const char* start = line.c_str();
+	char* end;
+	errno = 0;
+	long rr = strtol(start, &end, 10);
+	if (end == start || errno == ERANGE || rr < INT_MIN || rr > INT_MAX) // not a number, or too big for an int
+		return false;
+	start = end;
+	long cc = strtol(start, &end, 10);
+	if (end == start || errno == ERANGE || cc < INT_MIN || cc > INT_MAX)
+		return false;
+	r = rr;
+	c = cc;
+	return true;
 }
 
 class HumanPlayer : public Player {
@@ -92,7 +108,7 @@ private:
 };
 
 
-HumanPlayer::HumanPlayer(string nm, const Game& g) : Player(nm, g){}
+HumanPlayer::HumanPlayer(string nm, const Game& g) : Player(nm, g), m_lastCellAttacked(0, 0) {}
 
 bool HumanPlayer::placeShips(Board &b) { 
 	cout << Player::name() << " must place " << game().nShips() << " ships." << endl;
@@ -104,7 +120,8 @@ bool HumanPlayer::placeShips(Board &b) {
 		while (messedUp) { // as long as something is wrong, keep looping
 			string d;
 			cout << "Enter h or v for direction of " << game().shipName(i) << " (length " << game().shipLength(i) << "): ";
-			getline(cin, d); // using getline bc they could enter like "ko24" and that would be a huge error
+			if (!getline(cin, d)) // using getline bc they could enter like "ko24" and that would be a huge error
+				return false; // input is gone, so this ship can never be placed
 
 			if (d == "h") {
 				dir = HORIZONTAL;
@@ -131,6 +148,8 @@ bool HumanPlayer::placeShips(Board &b) {
 					cout << "The ship can not be placed there." << endl;
 				else
 					messedUp = false; // worked
+			else if (!cin)
+				return false; // input is gone, so stop asking
 			else
 				cout << "You must enter two integers." << endl;
 		}
@@ -141,10 +160,14 @@ bool HumanPlayer::placeShips(Board &b) {
 Point HumanPlayer::recommendAttack() { // prompting human for attack coordinates
 	int r, c;
 	cout << "Enter the row and column to attack (e.g. 3 5): ";
-	if (getLineWithTwoIntegers(r, c)) {
-		m_lastCellAttacked = Point(r, c);
-		return m_lastCellAttacked;
+	while (!getLineWithTwoIntegers(r, c)) { // keep asking until we actually get a point
+		if (!cin) // input is gone, so there is no point in asking again
+			return m_lastCellAttacked;
+		cout << "You must enter two integers." << endl;
+		cout << "Enter the row and column to attack (e.g. 3 5): ";
 	}
+	m_lastCellAttacked = Point(r, c);
+	return m_lastCellAttacked;
 }
 
 void HumanPlayer::recordAttackResult(Point p, bool validShot, bool shotHit, // these do nothing for humans
@@ -168,6 +191,94 @@ Direction getRandDirection() {
 		return VERTICAL;
 }
 
+// Tries to place ships k, k+1, ... on b, scanning cells in row-major order and trying
+// both directions at each (a random one first). Backtracks on failure and leaves b
+// without ships k and up if it returns false. Every placeShip call uses up one unit of
+// budget, and the search gives up once it runs out, since backtracking over a crowded
+// board can otherwise take exponential time.
+bool recursivePlaceShips(Board &b, const Game& g, int k, int& budget) {
+
+	if (k == g.nShips())
+		return true;
+
+	for (int r = 0; r < g.rows(); r++)
+		for (int c = 0; c < g.cols(); c++) {
+			Direction dirs[2];
+			dirs[0] = getRandDirection();
+			dirs[1] = (dirs[0] == HORIZONTAL) ? VERTICAL : HORIZONTAL;
+			for (int d = 0; d < 2; d++) {
+				if (budget <= 0) // out of time for this trial
+					return false;
+				budget--;
+				if (b.placeShip(Point(r, c), k, dirs[d])) { // if we can place the ship down
+					if (recursivePlaceShips(b, g, k + 1, budget))
+						return true;
+					b.unplaceShip(Point(r, c), k, dirs[d]); // if it fails other places, unplace the ship
+				}
+			}
+		}
+
+	return false;
+}
+
+// Like recursivePlaceShips, but tries the anchors (every cell in both directions) for each
+// ship in a random order, so on an open board the first few tries almost always fit and
+// the layout is still different every game. Uses the same placeShip budget.
+bool scatterShips(Board &b, const Game& g, int k, int& budget) {
+
+	if (k == g.nShips())
+		return true;
+
+	int nAnchors = g.rows() * g.cols() * 2;
+	vector<int> anchors(nAnchors); // cell * 2 + 0 for HORIZONTAL, + 1 for VERTICAL
+	for (int i = 0; i < nAnchors; i++)
+		anchors[i] = i;
+	for (int i = nAnchors - 1; i > 0; i--) // shuffle
+		swap(anchors[i], anchors[randInt(i + 1)]);
+
+	for (int i = 0; i < nAnchors; i++) {
+		Point p(anchors[i] / 2 / g.cols(), anchors[i] / 2 % g.cols());
+		Direction dir = (anchors[i] % 2 == 0) ? HORIZONTAL : VERTICAL;
+		if (budget <= 0) // out of time for this attempt
+			return false;
+		budget--;
+		if (b.placeShip(p, k, dir)) {
+			if (scatterShips(b, g, k + 1, budget))
+				return true;
+			b.unplaceShip(p, k, dir); // no room for the rest this way, so try the next anchor
+		}
+	}
+
+	return false;
+}
+
+// Placement shared by MediocrePlayer and GoodPlayer. Each trial blocks about half the
+// board so layouts vary from game to game. Blocking makes long ships hard to fit, so if
+// every trial fails we try again on the open board with the anchors shuffled; that still
+// starts with block() and ends with unblock(), as MediocrePlayer must. Every search gets
+// a fixed number of placeShip calls, so this always returns in bounded time, and it only
+// fails on fleets that are packed too tightly to find a layout within that budget.
+bool placeShipsRandomly(Board &b, const Game& g) {
+	for (int trial = 0; trial < 50; trial++) {
+		int budget = 20000;
+		b.block();
+		bool placed = recursivePlaceShips(b, g, 0, budget);
+		b.unblock();
+		if (placed)
+			return true;
+	}
+
+	b.block();
+	b.clear(); // no ships are down yet, so this just takes the blocks back off
+	bool placed = false;
+	for (int attempt = 0; attempt < 10 && !placed; attempt++) {
+		int budget = 20000;
+		placed = scatterShips(b, g, 0, budget);
+	}
+	b.unblock();
+	return placed;
+}
+
 
 
 //// TODO:  You need to replace this with a real class declaration and
@@ -180,99 +291,33 @@ public:
 	void recordAttackResult(Point p, bool validShot, bool shotHit,
 		bool shipDestroyed, int shipId);
 	virtual void recordAttackByOpponent(Point p);
-	bool recursivePlaceShips(Board &b, int k, int& count);
 private:
-	char grid[MAXROWS][MAXCOLS]; // another board to keep track of where I have taken shots
+	char& cell(int r, int c) { return grid[r * m_cols + c]; }
+
+	int m_cols; // row stride of grid
+	vector<char> grid; // another board to keep track of where I have taken shots, rows() x cols() in one block
 	Point m_sourceCell;
 	bool inSearch;
 };
 
 
-MediocrePlayer::MediocrePlayer(string nm, const Game& g) : Player(nm, g), inSearch(true) {
-	
+MediocrePlayer::MediocrePlayer(string nm, const Game& g)
+	: Player(nm, g), m_cols(g.cols()), grid(g.rows() * g.cols()), inSearch(true) {
+	for (int r = 0; r < game().rows(); r++) // nothing has been shot at yet
+		for (int c = 0; c < game().cols(); c++)
+			cell(r, c) = '.';
 }
 
 bool MediocrePlayer::placeShips(Board &b) {
-	
-	int k = 0, trial = 0, count;// used for shipId inside recursivePlaceShips
-	while (trial < 50) {
-		b.block();
-		count = 0;
-		trial++;
-		if (recursivePlaceShips(b, k, count)) {
-			b.unblock();
-			break;
-		}
-		b.unblock();
-	}
-	if (count == game().nShips())
-		return true;
-	return false;
-}
-
-bool MediocrePlayer::recursivePlaceShips(Board &b, int k, int& count) {
-
-	if (count == game().nShips())
-		return true;
-
-	for (int r = 0; r < game().rows(); r++)
-		for (int c = 0; c < game().cols(); c++) {
-			Direction dir = getRandDirection();
-			if (dir == HORIZONTAL) {
-				if (b.placeShip(Point(r, c), k, HORIZONTAL)) {// if we can place the ship down
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						count--;
-						b.unplaceShip(Point(r, c), k, HORIZONTAL);
-					}
-					else {
-						return true;
-					}
-
-				}
-				else if (b.placeShip(Point(r, c), k, VERTICAL)) {
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						b.unplaceShip(Point(r, c), k, VERTICAL);
-					}
-					else {
-						return true;
-					}
-				}
-			}
-			else {
-				if (b.placeShip(Point(r, c), k, VERTICAL)) {
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						--count;
-						b.unplaceShip(Point(r, c), k, VERTICAL);
-					}
-					else {
-						return true;
-					}
-				}
-				else if (b.placeShip(Point(r, c), k, HORIZONTAL)) {
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						--count;
-						b.unplaceShip(Point(r, c), k, HORIZONTAL);
-					}
-					else {
-						return true;
-					}
-				}
-			}
-		}
-
-	return false;
+	return placeShipsRandomly(b, game());
 }
 
 Point MediocrePlayer::recommendAttack() {
 	if (inSearch) {
 		Point ran(game().randomPoint()); // get random point
-		while (grid[ran.r][ran.c] == '#') // if that spot is marked, get a new random point
+		while (cell(ran.r, ran.c) == '#') // if that spot is marked, get a new random point
 			ran = game().randomPoint();
-		grid[ran.r][ran.c] = '#'; // mark that spot for later
+		cell(ran.r, ran.c) = '#'; // mark that spot for later
 		return ran;
 	}
 	else {
@@ -287,14 +332,14 @@ Point MediocrePlayer::recommendAttack() {
 			switch (p) {
 			case 0: // NORTH
 				worked = true;
-				while (grid[pnt.r][pnt.c] == '#') { // while it is blocked, keep finding new points
+				while (cell(pnt.r, pnt.c) == '#') { // while it is blocked, keep finding new points
 
 					// HARD CODE WARNING //
 					bool allBlocked = true;
 					for (int i = 1; i <= m_sourceCell.r; i++) { // testing if all the points
 						if (i > 4) // testing points out of range
 							break; // this will make it fail
-						if (grid[m_sourceCell.r - i][m_sourceCell.c] != '#') {
+						if (cell(m_sourceCell.r - i, m_sourceCell.c) != '#') {
 							allBlocked = false; // there is a free space!
 							break; // break out of for loop
 						}
@@ -309,14 +354,14 @@ Point MediocrePlayer::recommendAttack() {
 						pnt = Point(m_sourceCell.r - (randInt(4) + 1), m_sourceCell.c); // otherwise we got full range
 				}
 				if (worked) { // if everything was ok
-					grid[pnt.r][pnt.c] = '#'; // mark on board
+					cell(pnt.r, pnt.c) = '#'; // mark on board
 					bordered = false;
 					return pnt;
 				}
 				break;
 			case 1: // EAST
 				worked = true;
-				while (grid[pnt.r][pnt.c] == '#') {
+				while (cell(pnt.r, pnt.c) == '#') {
 
 					int dis = game().cols() - 1 - m_sourceCell.c; // dis from border
 					// HARD CODE WARNING //
@@ -324,7 +369,7 @@ Point MediocrePlayer::recommendAttack() {
 					for (int i = 1; i <= dis; i++) {
 						if (i > 4) // testing points out of range
 							break;
-						if (grid[m_sourceCell.r][m_sourceCell.c + i] != '#') {
+						if (cell(m_sourceCell.r, m_sourceCell.c + i) != '#') {
 							allBlocked = false;
 							break;
 						}
@@ -340,14 +385,14 @@ Point MediocrePlayer::recommendAttack() {
 						pnt = Point(m_sourceCell.r, m_sourceCell.c + (randInt(4) + 1)); // otherwise we got full range
 				}
 				if (worked) {
-					grid[pnt.r][pnt.c] = '#'; // mark on board
+					cell(pnt.r, pnt.c) = '#'; // mark on board
 					bordered = false;
 					return pnt;
 				}
 				break;
 			case 2: // SOUTH
 				worked = true;
-				while (grid[pnt.r][pnt.c] == '#') {
+				while (cell(pnt.r, pnt.c) == '#') {
 
 					int dis = game().rows() - 1 - m_sourceCell.r; // dis from border
 					// HARD CODE WARNING //
@@ -355,7 +400,7 @@ Point MediocrePlayer::recommendAttack() {
 					for (int i = 1; i <= dis; i++) {
 						if (i > 4)
 							break;
-						if (grid[m_sourceCell.r + i][m_sourceCell.c] != '#') {
+						if (cell(m_sourceCell.r + i, m_sourceCell.c) != '#') {
 							allBlocked = false;
 							break;
 						}
@@ -371,21 +416,21 @@ Point MediocrePlayer::recommendAttack() {
 						pnt = Point(m_sourceCell.r + (randInt(4) + 1), m_sourceCell.c); // otherwise we got full range
 				}
 				if (worked) {
-					grid[pnt.r][pnt.c] = '#'; // mark on board
+					cell(pnt.r, pnt.c) = '#'; // mark on board
 					bordered = false;
 					return pnt;
 				}
 				break;
 			case 3: // WEST
 				worked = true;
-				while (grid[pnt.r][pnt.c] == '#') { // while blocked, keep trying to find a new point
+				while (cell(pnt.r, pnt.c) == '#') { // while blocked, keep trying to find a new point
 					
 					// HARD CODE WARNING //
 					bool allBlocked = true;
 					for (int i = 1; i <= m_sourceCell.c; i++) {
 						if (i > 4)
 							break;
-						if (grid[m_sourceCell.r][m_sourceCell.c - i] != '#') {
+						if (cell(m_sourceCell.r, m_sourceCell.c - i) != '#') {
 							allBlocked = false;
 							break;
 						}
@@ -401,7 +446,7 @@ Point MediocrePlayer::recommendAttack() {
 						pnt = Point(m_sourceCell.r, m_sourceCell.c - (randInt(4) + 1)); // otherwise we got full range
 				}
 				if (worked) {
-					grid[pnt.r][pnt.c] = '#'; // mark on board
+					cell(pnt.r, pnt.c) = '#'; // mark on board
 					bordered = false;
 					return pnt;
 				}
@@ -459,179 +504,137 @@ public:
 	void recordAttackResult(Point p, bool validShot, bool shotHit,
 		bool shipDestroyed, int shipId);
 	virtual void recordAttackByOpponent(Point p);
-bool recursivePlaceShips(Board &b, int k, int& count);
 private:
-	char grid[MAXROWS][MAXCOLS]; // another board to keep track of where I have taken shots
+	char& cell(int r, int c) { return grid[r * m_cols + c]; }
+	bool canHoldShip(Point p); // false if no ship still afloat could cover p
+	int smallestShipLeft() const;
+	void readFleet();
+
+	int m_cols; // row stride of grid
+	vector<char> grid; // cells we have shot at: '.' not yet, 'X' hit, '#' anything else; rows() x cols() in one block
+	vector<Point> m_huntOrder; // checker board search order, worked out once for this board size
+	size_t m_huntNext; // first entry of m_huntOrder that might not have been shot at yet
+	vector<bool> m_sunk; // m_sunk[shipId] is true once we have destroyed that ship; sized in placeShips
+	int m_smallestLeft; // length of the smallest ship we haven't destroyed yet
+	bool m_bigShips; // true if any ship is 6 or longer
+	vector<int> m_seen; // m_seen[cell] == m_searchId if the current targeting search has queued that cell
+	int m_searchId; // bumped for each targeting search, so m_seen never needs clearing
+	vector<Point> m_frontier; // queue for the targeting search, kept so its storage gets reused
 	Point m_sourceCell;
 	bool inSearch;
 
 };
 
 
-GoodPlayer::GoodPlayer(string nm, const Game& g) : Player(nm, g), inSearch(true) {}
+GoodPlayer::GoodPlayer(string nm, const Game& g)
+	: Player(nm, g), m_cols(g.cols()), grid(g.rows() * g.cols()), m_huntNext(0),
+	m_smallestLeft(1), m_bigShips(false), m_seen(g.rows() * g.cols(), 0), m_searchId(0), inSearch(true) {
+	for (int r = 0; r < game().rows(); r++) // nothing has been shot at yet
+		for (int c = 0; c < game().cols(); c++)
+			cell(r, c) = '.';
 
-bool GoodPlayer::placeShips(Board &b) {
+	// the search order only depends on the board size: odd cells of the checker board, then even ones
+	m_huntOrder.reserve(game().rows() * game().cols());
+	for (int parity = 1; parity >= 0; parity--)
+		for (int r = 0; r < game().rows(); r++)
+			for (int c = 0; c < game().cols(); c++)
+				if ((r + c) % 2 == parity)
+					m_huntOrder.push_back(Point(r, c));
+}
 
-	int k = 0, trial = 0, count;// used for shipId inside recursivePlaceShips
-	while (trial < 50) {
-		b.block();
-		count = 0;
-		trial++;
-		if (recursivePlaceShips(b, k, count)) {
-			b.unblock();
-			break;
-		}
-		b.unblock();
-	}
-	if (count == game().nShips())
-		return true;
-	return false;
+bool GoodPlayer::placeShips(Board &b) {
+	readFleet();
+	return placeShipsRandomly(b, game());
 }
 
-bool GoodPlayer::recursivePlaceShips(Board &b, int k, int& count) {
+void GoodPlayer::readFleet() {
+	// ships can still be added to the game after we are created, but not once ships are
+	// being placed, so this is the earliest point where the fleet is final
+	m_sunk.assign(game().nShips(), false);
+	m_smallestLeft = smallestShipLeft();
+	m_bigShips = false;
+	for (int i = 0; i < game().nShips(); i++)
+		if (game().shipLength(i) >= 6)
+			m_bigShips = true;
+}
 
-	if (count == game().nShips())
+bool GoodPlayer::canHoldShip(Point p) {
+	// a miss can't be part of any ship, so count the unbroken run of non-miss cells through p
+	// along its row and its column; if neither is as long as the smallest ship still afloat, p is dead
+	int across = 1;
+	for (int c = p.c - 1; c >= 0 && cell(p.r, c) != '#'; c--)
+		across++;
+	for (int c = p.c + 1; c < game().cols() && cell(p.r, c) != '#'; c++)
+		across++;
+	if (across >= m_smallestLeft)
 		return true;
 
-	for (int r = 0; r < game().rows(); r++)
-		for (int c = 0; c < game().cols(); c++) {
-			Direction dir = getRandDirection();
-			if (dir == HORIZONTAL) {
-				if (b.placeShip(Point(r, c), k, HORIZONTAL)) {// if we can place the ship down
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						count--;
-						b.unplaceShip(Point(r, c), k, HORIZONTAL);
-					}
-					else {
-						return true;
-					}
-
-				}
-				else if (b.placeShip(Point(r, c), k, VERTICAL)) {
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						b.unplaceShip(Point(r, c), k, VERTICAL);
-					}
-					else {
-						return true;
-					}
-				}
-			}
-			else {
-				if (b.placeShip(Point(r, c), k, VERTICAL)) {
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						--count;
-						b.unplaceShip(Point(r, c), k, VERTICAL);
-					}
-					else {
-						return true;
-					}
-				}
-				else if (b.placeShip(Point(r, c), k, HORIZONTAL)) {
-					count++;
-					if (!recursivePlaceShips(b, k + 1, count)) { // if it fails other places, unplace the ship
-						--count;
-						b.unplaceShip(Point(r, c), k, HORIZONTAL);
-					}
-					else {
-						return true;
-					}
-				}
-			}
-		}
-
-	return false;
+	int down = 1;
+	for (int r = p.r - 1; r >= 0 && cell(r, p.c) != '#'; r--)
+		down++;
+	for (int r = p.r + 1; r < game().rows() && cell(r, p.c) != '#'; r++)
+		down++;
+	return down >= m_smallestLeft;
 }
 
 Point GoodPlayer::recommendAttack() {
 	if (inSearch) { // checker board random
 		Point p;
-		for (int r = 0; r < game().rows(); r++) {
-			for (int c = 0; c < game().cols(); c++)
-				if ((r + c) % 2 != 0 && grid[r][c] != '#') {
-					p = Point(r, c);
-					grid[p.r][p.c] = '#';
-					return p;
-				}
-		}
-		for (int r = 0; r < game().rows(); r++) {
-			for (int c = 0; c < game().cols(); c++)
-				if ((r + c) % 2 == 0 && grid[r][c] != '#'){
-				p = Point(r, c);
-				grid[p.r][p.c] = '#';
+		// cells never get unshot and dead cells never come back to life, so anything before
+		// m_huntNext is done for good and we pick up where we left off
+		while (m_huntNext < m_huntOrder.size()) {
+			p = m_huntOrder[m_huntNext++];
+			if (cell(p.r, p.c) == '.' && canHoldShip(p)) {
+				cell(p.r, p.c) = '#';
 				return p;
-				}
+			}
 		}
-		grid[p.r][p.c] = '#'; // safety in case rows() is zero or something
+		cell(p.r, p.c) = '#'; // safety in case rows() is zero or something
 		return p;
 	}
 	else {
-		queue<Point> myPoints;
-		myPoints.push(m_sourceCell);
-
-		while (!myPoints.empty()) {
-			Point current = myPoints.front();
-			myPoints.pop();
-			if (grid[current.r][current.c] == '#') {
-				if (current.r > 0) {
-					if (grid[current.r - 1][current.c] != '#') { // NORTH //
-						grid[current.r - 1][current.c] = '#';
-						return Point(current.r - 1, current.c); // found available space
-					}
-					else
-					{
-						myPoints.push(Point(current.r - 1, current.c));
-					}
-				}
-
-				if (game().cols() - 1 - current.c > 0) {
-					if (grid[current.r][current.c + 1] != '#') { // EAST //
-						grid[current.r][current.c + 1] = '#';
-						return Point(current.r, current.c + 1); // found available space
-					}
-					else
-					{
-						myPoints.push(Point(current.r, current.c + 1));
-					}
-				}
-
-				if (game().rows() - 1 - current.r > 0) {
-					if (grid[current.r + 1][current.c] != '#') { // SOUTH //
-						grid[current.r + 1][current.c] = '#';
-						return Point(current.r + 1, current.c); // found available space
-					}
-					else
-					{
-						myPoints.push(Point(current.r + 1, current.c));
-					}
-				}
-
-				if (current.c > 0) {
-					if (grid[current.r][current.c - 1] != '#') { // WEST //
-						grid[current.r][current.c - 1] = '#';
-						return Point(current.r, current.c - 1); // found available space
-					}
-					else
-					{
-						myPoints.push(Point(current.r, current.c - 1));
-					}
+		// spread out from the source cell through cells we hit (never through misses, a ship can't
+		// continue past one) and shoot the first open neighbour, checking NORTH, EAST, SOUTH, WEST
+		static const int dr[4] = { -1, 0, 1, 0 };
+		static const int dc[4] = { 0, 1, 0, -1 };
+		m_searchId++; // each cell goes into the queue at most once per search
+		m_frontier.clear();
+		m_frontier.push_back(m_sourceCell);
+		m_seen[m_sourceCell.r * m_cols + m_sourceCell.c] = m_searchId;
+
+		for (size_t head = 0; head < m_frontier.size(); head++) {
+			Point current = m_frontier[head];
+			for (int d = 0; d < 4; d++) {
+				Point next(current.r + dr[d], current.c + dc[d]);
+				if (!game().isValid(next) || m_seen[next.r * m_cols + next.c] == m_searchId)
+					continue;
+				m_seen[next.r * m_cols + next.c] = m_searchId;
+				if (cell(next.r, next.c) == 'X')
+					m_frontier.push_back(next); // part of a ship, keep looking past it
+				else if (cell(next.r, next.c) == '.' && canHoldShip(next)) {
+					cell(next.r, next.c) = '#';
+					return next; // found available space
 				}
 			}
 		}
+
+		// everything around these hits has been shot at, so go back to searching
+		inSearch = true;
+		return recommendAttack();
 	}
 }
 
 void GoodPlayer::recordAttackResult(Point p, bool validShot, bool shotHit,
 	bool shipDestroyed, int shipId) {
 	
-	bool bigShips = false;
-	for (int i = 0; i < game().nShips(); i++) {
-		if (game().shipLength(i) >= 6)
-			bigShips = true;
+	if (validShot && shotHit)
+		cell(p.r, p.c) = 'X'; // remember hits apart from misses so the search can follow them
+	if (validShot && shipDestroyed && shipId >= 0 && shipId < (int)m_sunk.size()) {
+		m_sunk[shipId] = true;
+		m_smallestLeft = smallestShipLeft();
 	}
-	if (bigShips) {
+
+	if (m_bigShips) {
 		inSearch = true; // if the game has ships of length of 6 or more, switch to state1
 	}
 	else {
@@ -648,6 +651,14 @@ void GoodPlayer::recordAttackResult(Point p, bool validShot, bool shotHit,
 	}
 }
 
+int GoodPlayer::smallestShipLeft() const {
+	int smallest = game().rows() + game().cols(); // longer than anything that fits
+	for (int i = 0; i < (int)m_sunk.size(); i++)
+		if (!m_sunk[i] && game().shipLength(i) < smallest)
+			smallest = game().shipLength(i);
+	return smallest;
+}
+
 void GoodPlayer::recordAttackByOpponent(Point p) {
 	// do nothing. It really won't make him play any different. ALWAYS PLAY TO WIN
 }